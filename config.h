@@ -2,7 +2,9 @@
  * config.h - Obscura Configuration Header
  *
  * Include this header to enable explicit control over encryption behavior.
- * All options are configured via compiler flags (-D).
+ * Options are configured via compiler flags (-D). Planned options whose values
+ * must not end up in the binary, such as a seed or a report path, will be
+ * passed to the plugin with -mllvm instead (see docs/ENCRYPTION.md).
  *
  * See README.md for complete documentation.
  */
@@ -64,6 +66,44 @@ __attribute__((used)) static int __enc_deep_times = ENC_DEEP_TIMES;
 __attribute__((used)) static int __enc_deep_inline = 1;
 #endif
 
+/*============================================================================*
+ * PER-VARIABLE OPTIONS
+ *============================================================================*/
+
+/* Override the module settings for a single variable (planned, ignored by
+ * current releases). Read from IR metadata for globals and from
+ * @llvm.var.annotation for locals, like NO_ENC:
+ *   ENC_TIMES(10) ENC_LEVEL(deep) ENC_INLINE static int32_t master_key = 1;
+ *   ENC_LEVEL(lite) ENC_LAZY static int32_t buffer_size = 4096;
+ */
+#define __ENC_STR(x) #x
+
+/* ENC_TIMES(n) - iteration count for every level applied to the variable */
+#define ENC_TIMES(n) __attribute__((annotate("enc_times=" __ENC_STR(n))))
+
+/* ENC_LEVEL(lite), ENC_LEVEL(deep) or ENC_LEVEL(full) */
+#define ENC_LEVEL(level) __attribute__((annotate("enc_level=" __ENC_STR(level))))
+
+/* Deep decryption inlined at each use site / called as a function */
+#define ENC_INLINE __attribute__((annotate("enc_inline")))
+#define ENC_OUTLINE __attribute__((annotate("enc_outline")))
+
+/* Decrypt once at startup / once on first use, then read the cached value */
+#define ENC_EAGER __attribute__((annotate("enc_eager")))
+#define ENC_LAZY __attribute__((annotate("enc_lazy")))
+
+/*============================================================================*
+ * PER-FUNCTION OPTIONS
+ *============================================================================*/
+
+/* Control where decryption code goes inside a function (planned, ignored by
+ * current releases):
+ *   ENC_HOT_FN void request_loop(void);   // decrypt read-only globals once
+ *   ENC_COLD_FN int check_license(void);  // inline Deep decryption everywhere
+ */
+#define ENC_HOT_FN __attribute__((annotate("enc_hot_fn")))
+#define ENC_COLD_FN __attribute__((annotate("enc_cold_fn")))
+
 /*============================================================================*
  * FILTERS - Variable Selection
  *============================================================================*/